@@ -2,6 +2,11 @@
 #include <fstream>
 #include <string>
 #include <sstream>
+#include <cstdint>
+#include <thread>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
 using namespace std;
 
 // ----------------------- Custom Queue -----------------------
@@ -270,10 +275,43 @@ public:
 // Maximum number of books the graph can store
 const int MAX_BOOKS = 100;
 
+// Number of 64-bit words in one packed adjacency row
+const int ROW_WORDS = (MAX_BOOKS + 63) / 64;
+
+// Books with fewer related books than this are compared using their sorted lists
+const int SPARSE_DEGREE = 8;
+
+// Largest number of results returned by a top-k similarity query
+const int MAX_TOP_K = 10;
+
+// Largest number of worker threads used for all-pairs similarity
+const int MAX_THREADS = 8;
+
+// Count the set bits in a 64-bit word
+inline int popcount64(uint64_t x) {
+#if defined(_MSC_VER) && defined(_M_X64)
+    return (int)__popcnt64(x);
+#elif defined(_MSC_VER)
+    return (int)(__popcnt((unsigned int)x) + __popcnt((unsigned int)(x >> 32)));
+#else
+    return __builtin_popcountll(x);
+#endif
+}
+
+// A pair of books and how similar they are
+struct SimilarPair {
+    int book1;
+    int book2;
+    int common;     // Number of related books they share
+    double score;   // Jaccard similarity of their related books
+};
+
 class Graph {
 private:
     string books[MAX_BOOKS];  // Array to store book titles
-    bool adjMatrix[MAX_BOOKS][MAX_BOOKS];  // Adjacency matrix
+    uint64_t adjBits[MAX_BOOKS][ROW_WORDS];  // Bit-packed adjacency matrix
+    int neighbours[MAX_BOOKS][MAX_BOOKS];  // Sorted list of related books for each book
+    int degree[MAX_BOOKS];  // Number of related books for each book
     int bookCount;  // Current number of books in the graph
 
     // Helper function to find the index of a book by its title
@@ -284,13 +322,105 @@ private:
         return -1;  // Book not found
     }
 
+    bool hasEdge(int index1, int index2) const {
+        return (adjBits[index1][index2 / 64] >> (index2 % 64)) & 1;
+    }
+
+    // Set the edge bit and keep the neighbour list sorted
+    void linkBooks(int from, int to) {
+        adjBits[from][to / 64] |= (uint64_t)1 << (to % 64);
+        int pos = degree[from]++;
+        while (pos > 0 && neighbours[from][pos - 1] > to) {
+            neighbours[from][pos] = neighbours[from][pos - 1];
+            pos--;
+        }
+        neighbours[from][pos] = to;
+    }
+
+    // Count related books shared by two books.
+    // Two sparse books merge their sorted lists, a sparse and a dense book probe
+    // the dense bit row with the sparse list, and two dense books AND their bit rows.
+    int commonCount(int index1, int index2) const {
+        bool sparse1 = degree[index1] < SPARSE_DEGREE;
+        bool sparse2 = degree[index2] < SPARSE_DEGREE;
+        if (sparse1 && sparse2) {
+            int i = 0, j = 0, count = 0;
+            while (i < degree[index1] && j < degree[index2]) {
+                if (neighbours[index1][i] < neighbours[index2][j]) i++;
+                else if (neighbours[index1][i] > neighbours[index2][j]) j++;
+                else { count++; i++; j++; }
+            }
+            return count;
+        }
+        if (sparse1 || sparse2) {
+            int sparse = sparse1 ? index1 : index2;
+            int dense = sparse1 ? index2 : index1;
+            int count = 0;
+            for (int i = 0; i < degree[sparse]; i++) {
+                if (hasEdge(dense, neighbours[sparse][i])) count++;
+            }
+            return count;
+        }
+        int count = 0;
+        for (int w = 0; w < ROW_WORDS; w++) {
+            count += popcount64(adjBits[index1][w] & adjBits[index2][w]);
+        }
+        return count;
+    }
+
+    // Count books related to either of two books, given how many they share
+    int unionCount(int index1, int index2, int common) const {
+        return degree[index1] + degree[index2] - common;
+    }
+
+    // Jaccard similarity from an already computed shared count
+    double jaccard(int index1, int index2, int common) const {
+        int total = unionCount(index1, index2, common);
+        if (total == 0) return 0.0;
+        return (double)common / total;
+    }
+
+    // Order pairs by descending score, then by book indices so ties are deterministic
+    static bool ranksBefore(const SimilarPair& a, const SimilarPair& b) {
+        if (a.score != b.score) return a.score > b.score;
+        if (a.book1 != b.book1) return a.book1 < b.book1;
+        return a.book2 < b.book2;
+    }
+
+    // Insert a pair into a top-k list kept in ranksBefore order
+    static void insertTopK(SimilarPair list[], int& size, int k, const SimilarPair& pair) {
+        if (size == k && !ranksBefore(pair, list[size - 1])) return;
+        int pos = (size < k) ? size++ : size - 1;
+        while (pos > 0 && ranksBefore(pair, list[pos - 1])) {
+            list[pos] = list[pos - 1];
+            pos--;
+        }
+        list[pos] = pair;
+    }
+
+    // Worker for topSimilarPairs: scores every row i where i % threadCount == start
+    void scoreRows(int start, int threadCount, int k, bool unlinkedOnly,
+                   SimilarPair list[], int* size) const {
+        *size = 0;
+        for (int i = start; i < bookCount; i += threadCount) {
+            for (int j = i + 1; j < bookCount; j++) {
+                if (unlinkedOnly && hasEdge(i, j)) continue;
+                int common = commonCount(i, j);
+                if (common == 0) continue;
+                SimilarPair pair = { i, j, common, jaccard(i, j, common) };
+                insertTopK(list, *size, k, pair);
+            }
+        }
+    }
+
 public:
     Graph() : bookCount(0) {
-        // Initialize the adjacency matrix to false
+        // Initialize the adjacency matrix and neighbour lists to empty
         for (int i = 0; i < MAX_BOOKS; i++) {
-            for (int j = 0; j < MAX_BOOKS; j++) {
-                adjMatrix[i][j] = false;
+            for (int w = 0; w < ROW_WORDS; w++) {
+                adjBits[i][w] = 0;
             }
+            degree[i] = 0;
         }
     }
 
@@ -316,9 +446,10 @@ public:
             cout << "One or both books not found in the graph." << endl;
             return;
         }
+        if (hasEdge(index1, index2)) return;  // Already related
 
-        adjMatrix[index1][index2] = true;
-        adjMatrix[index2][index1] = true;  // For undirected graph
+        linkBooks(index1, index2);
+        if (index1 != index2) linkBooks(index2, index1);  // For undirected graph
     }
 
     // Display recommendations for a given book (BFS approach)
@@ -330,11 +461,90 @@ public:
         }
 
         cout << "Recommendations for \"" << title << "\":" << endl;
-        for (int i = 0; i < bookCount; i++) {
-            if (adjMatrix[index][i]) {
-                cout << "- " << books[i] << endl;
+        for (int i = 0; i < degree[index]; i++) {
+            cout << "- " << books[neighbours[index][i]] << endl;
+        }
+    }
+
+    // Display books related to both of the given books
+    void commonRecommendations(const string& book1, const string& book2) {
+        int index1 = findBookIndex(book1);
+        int index2 = findBookIndex(book2);
+        if (index1 == -1 || index2 == -1) {
+            cout << "One or both books not found in the graph." << endl;
+            return;
+        }
+
+        cout << "Books related to both \"" << book1 << "\" and \"" << book2 << "\":" << endl;
+        for (int w = 0; w < ROW_WORDS; w++) {
+            uint64_t bits = adjBits[index1][w] & adjBits[index2][w];
+            for (int b = 0; bits; b++, bits >>= 1) {
+                if (bits & 1) cout << "- " << books[w * 64 + b] << endl;
+            }
+        }
+    }
+
+    // Display how similar two books are based on the books related to them
+    void similarity(const string& book1, const string& book2) {
+        int index1 = findBookIndex(book1);
+        int index2 = findBookIndex(book2);
+        if (index1 == -1 || index2 == -1) {
+            cout << "One or both books not found in the graph." << endl;
+            return;
+        }
+
+        int common = commonCount(index1, index2);
+        cout << "Shared related books: " << common << endl;
+        cout << "Total related books: " << unionCount(index1, index2, common) << endl;
+        cout << "Similarity: " << jaccard(index1, index2, common) << endl;
+    }
+
+    // Find the k most similar pairs of books, scoring rows on several threads.
+    // With unlinkedOnly set, pairs that are already related are skipped so the
+    // result can be used to suggest new relationships.
+    int topSimilarPairs(int k, bool unlinkedOnly, SimilarPair result[]) const {
+        if (k > MAX_TOP_K) k = MAX_TOP_K;
+        if (k <= 0) return 0;
+
+        int threadCount = (int)thread::hardware_concurrency();
+        if (threadCount < 1) threadCount = 1;
+        if (threadCount > MAX_THREADS) threadCount = MAX_THREADS;
+        if (threadCount > bookCount) threadCount = (bookCount > 0) ? bookCount : 1;
+
+        SimilarPair lists[MAX_THREADS][MAX_TOP_K];
+        int sizes[MAX_THREADS];
+        thread workers[MAX_THREADS];
+        for (int t = 1; t < threadCount; t++) {
+            workers[t] = thread(&Graph::scoreRows, this, t, threadCount, k, unlinkedOnly,
+                                lists[t], &sizes[t]);
+        }
+        scoreRows(0, threadCount, k, unlinkedOnly, lists[0], &sizes[0]);
+        for (int t = 1; t < threadCount; t++) {
+            workers[t].join();
+        }
+
+        // Merge the per-thread lists
+        int size = 0;
+        for (int t = 0; t < threadCount; t++) {
+            for (int i = 0; i < sizes[t]; i++) {
+                insertTopK(result, size, k, lists[t][i]);
             }
         }
+        return size;
+    }
+
+    // Display the k most similar pairs of books
+    void displaySimilarPairs(int k, bool unlinkedOnly) {
+        SimilarPair result[MAX_TOP_K];
+        int size = topSimilarPairs(k, unlinkedOnly, result);
+        if (size == 0) {
+            cout << "No similar books found." << endl;
+            return;
+        }
+        for (int i = 0; i < size; i++) {
+            cout << "- " << books[result[i].book1] << " & " << books[result[i].book2]
+                 << " (shared: " << result[i].common << ", similarity: " << result[i].score << ")" << endl;
+        }
     }
 
     // Display the adjacency matrix
@@ -349,7 +559,7 @@ public:
         for (int i = 0; i < bookCount; i++) {
             cout << books[i] << "\t";
             for (int j = 0; j < bookCount; j++) {
-                cout << adjMatrix[i][j] << "\t";
+                cout << hasEdge(i, j) << "\t";
             }
             cout << endl;
         }
@@ -542,6 +752,26 @@ public:
         bookGraph.recommendBooks(title);
     }
 
+    // Books related to both of the given books
+    void commonRecommendations(string book1, string book2) {
+        bookGraph.commonRecommendations(book1, book2);
+    }
+
+    // Similarity between two books
+    void bookSimilarity(string book1, string book2) {
+        bookGraph.similarity(book1, book2);
+    }
+
+    // Most similar pairs of books
+    void similarBooks(int k) {
+        bookGraph.displaySimilarPairs(k, false);
+    }
+
+    // Suggest relationships between similar books that are not yet related
+    void suggestRelationships(int k) {
+        bookGraph.displaySimilarPairs(k, true);
+    }
+
     // Display the graph
     void displayGraph() {
         bookGraph.displayGraph();
@@ -555,8 +785,8 @@ int main() {
     library.loadBooksFromFile("books.txt");
     library.loadMembersFromFile("members.txt");
 
-    int choice;
-    string title, author, ISBN, memberId, name;
+    int choice, topK;
+    string title, title2, author, ISBN, memberId, name;
 
     while (true) {
         cout << "\n--- KSK Library Management System ---\n";
@@ -576,7 +806,7 @@ int main() {
                 int adminChoice;
                 do {
                     cout << "\n--- Admin Menu ---\n";
-                    cout << "1. Display Books\n2. Add Book\n3. Remove Book\n4. Display Members\n5. Add Member\n6. Remove Member\n7. Display History\n8. Add RelationShip btw Book\n9. Display Graph\n10. Back to Main Menu\nEnter choice: ";
+                    cout << "1. Display Books\n2. Add Book\n3. Remove Book\n4. Display Members\n5. Add Member\n6. Remove Member\n7. Display History\n8. Add RelationShip btw Book\n9. Display Graph\n10. Suggest Relationships\n11. Back to Main Menu\nEnter choice: ";
                     cin >> adminChoice;
                     cin.ignore();
 
@@ -614,8 +844,12 @@ int main() {
                     case 9:
                         library.displayGraph();
                         break;
+                    case 10:
+                        cout << "Enter number of suggestions: "; cin >> topK; cin.ignore();
+                        library.suggestRelationships(topK);
+                        break;
                     }
-                } while (adminChoice != 10);
+                } while (adminChoice != 11);
             }
             else
             {
@@ -635,7 +869,7 @@ int main() {
                 int memberChoice;
                 do {
                     cout << "\n--- Member Menu ---\n";
-                    cout << "1. Display Books\n2. Borrow Book\n3. Return Book\n4. Recommended books\n5. Back to Main Menu\nEnter choice: ";
+                    cout << "1. Display Books\n2. Borrow Book\n3. Return Book\n4. Recommended books\n5. Books Related to Both\n6. Book Similarity\n7. Most Similar Books\n8. Back to Main Menu\nEnter choice: ";
                     cin >> memberChoice;
                     cin.ignore();
 
@@ -651,9 +885,24 @@ int main() {
                         break;
                     case 4:
                         library.displayGraph();
+                        break;
+                    case 5:
+                        cout << "Enter the title of the first book: "; getline(cin, title);
+                        cout << "Enter the title of the second book: "; getline(cin, title2);
+                        library.commonRecommendations(title, title2);
+                        break;
+                    case 6:
+                        cout << "Enter the title of the first book: "; getline(cin, title);
+                        cout << "Enter the title of the second book: "; getline(cin, title2);
+                        library.bookSimilarity(title, title2);
+                        break;
+                    case 7:
+                        cout << "Enter number of results: "; cin >> topK; cin.ignore();
+                        library.similarBooks(topK);
+                        break;
                     }
 
-                } while (memberChoice != 5);
+                } while (memberChoice != 8);
             }
             else
             {